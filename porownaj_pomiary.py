@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+Porownuje dwa pliki JSON z wynikami pomiarow (program skompilowany z -DPOMIAR
+lub Google Benchmark) i zglasza pomiary, ktore zwolnily o wiecej niz zadany prog
+oraz o wiecej niz rozrzut pomiaru ('cpu_time_spread') w ktoromkolwiek z plikow.
+
+Uzycie:
+    python3 porownaj_pomiary.py BAZOWY.json NOWY.json [--prog PROCENT] [--czas real_time|cpu_time]
+    python3 porownaj_pomiary.py --scal WYNIK.json [WYNIK.json ...] > BAZOWY.json
+
+W trybie '--scal' laczy wyniki kilku uruchomien w jeden plik: dla kazdego pomiaru
+zachowuje uruchomienie z najmniejszym czasem procesora, a jako rozrzut zapisuje
+wiekszy z rozrzutow wewnatrz uruchomien i roznicy miedzy uruchomieniami. Plik bazowy
+zbudowany w ten sposob przenosi szum konkretnej maszyny, wiec prog moze pozostac niski.
+
+Konczy prace z kodem '1' jezeli ktorykolwiek pomiar zwolnil ponad prog i rozrzut,
+w przeciwnym wypadku z kodem '0'.
+"""
+
+import argparse
+import json
+import sys
+
+
+def wczytaj(sciezka, pole_czasu):
+    """Zwraca slownik nazwa pomiaru -> (czas w nanosekundach, rozrzut w procentach)."""
+    mnozniki = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+    with open(sciezka) as plik:
+        dane = json.load(plik)
+
+    return {
+        pomiar["name"]: (pomiar[pole_czasu] * mnozniki[pomiar.get("time_unit", "ns")],
+                         pomiar.get("cpu_time_spread", 0.0))
+        for pomiar in dane["benchmarks"]
+    }
+
+
+def scal(sciezki):
+    """Wypisuje na standardowe wyjscie wyniki kilku uruchomien polaczone w jeden plik."""
+    uruchomienia = []
+
+    for sciezka in sciezki:
+        with open(sciezka) as plik:
+            uruchomienia.append(json.load(plik))
+
+    wynik = {"context": uruchomienia[0].get("context", {}), "benchmarks": []}
+
+    for pomiar in uruchomienia[0]["benchmarks"]:
+        wersje = [p for dane in uruchomienia for p in dane["benchmarks"]
+                  if p["name"] == pomiar["name"]]
+        najlepszy = dict(min(wersje, key=lambda p: p["cpu_time"]))
+        najgorszy = max(wersje, key=lambda p: p["cpu_time"])
+
+        miedzy_uruchomieniami = (najgorszy["cpu_time"] - najlepszy["cpu_time"]) \
+            / najlepszy["cpu_time"] * 100.0
+        najlepszy["cpu_time_spread"] = round(max(
+            [miedzy_uruchomieniami] + [p.get("cpu_time_spread", 0.0) for p in wersje]), 2)
+        wynik["benchmarks"].append(najlepszy)
+
+    print("{")
+    print('  "context": %s,' % json.dumps(wynik["context"]))
+    print('  "benchmarks": [')
+    print(",\n".join("    " + json.dumps(p) for p in wynik["benchmarks"]))
+    print("  ]")
+    print("}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Porownanie wynikow pomiarow z plikiem bazowym.")
+    parser.add_argument("pliki", nargs="+", metavar="PLIK",
+                        help="plik bazowy i plik z nowymi wynikami albo, z '--scal', wyniki do polaczenia")
+    parser.add_argument("--scal", action="store_true",
+                        help="polacz wyniki kilku uruchomien w plik bazowy")
+    parser.add_argument("--prog", type=float, default=10.0,
+                        help="dopuszczalne spowolnienie w procentach (domyslnie 10)")
+    parser.add_argument("--czas", choices=["real_time", "cpu_time"], default="cpu_time",
+                        help="porownywane pole czasu (domyslnie cpu_time)")
+    argumenty = parser.parse_args()
+
+    if argumenty.scal:
+        scal(argumenty.pliki)
+        return 0
+
+    if len(argumenty.pliki) != 2:
+        parser.error("potrzebne sa dokladnie dwa pliki: bazowy i nowy")
+
+    bazowe = wczytaj(argumenty.pliki[0], argumenty.czas)
+    nowe = wczytaj(argumenty.pliki[1], argumenty.czas)
+    regresje = 0
+
+    print("%-32s %12s %12s %9s %9s" % ("pomiar", "bazowy [ns]", "nowy [ns]", "zmiana", "rozrzut"))
+
+    for nazwa, (czas_bazowy, rozrzut_bazowy) in bazowe.items():
+        if nazwa not in nowe:
+            print("%-32s %12.1f %12s %9s %9s  BRAK" % (nazwa, czas_bazowy, "-", "-", "-"))
+            continue
+
+        czas_nowy, rozrzut_nowy = nowe[nazwa]
+        zmiana = (czas_nowy - czas_bazowy) / czas_bazowy * 100.0
+        # zmiana mniejsza od rozrzutu ktoregokolwiek z pomiarow nie odroznia sie od szumu
+        rozrzut = max(rozrzut_bazowy, rozrzut_nowy)
+        regresja = zmiana > argumenty.prog and zmiana > rozrzut
+        regresje += regresja
+
+        print("%-32s %12.1f %12.1f %+8.1f%% %8.1f%%%s" % (
+            nazwa, czas_bazowy, czas_nowy, zmiana, rozrzut, "  REGRESJA" if regresja else ""))
+
+    for nazwa in nowe:
+        if nazwa not in bazowe:
+            print("%-32s %12s %12.1f %9s %9s  NOWY" % (nazwa, "-", nowe[nazwa][0], "-", "-"))
+
+    if regresje:
+        print("Liczba pomiarow wolniejszych o ponad %.1f%% i ponad rozrzut: %d"
+              % (argumenty.prog, regresje))
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -41,7 +41,8 @@
     WEJSCIE:
     Polecenia graczy zajmujace jeden wiersz.  Wszystkie polecenia mają poprawną postac
     i koncza sie reprezentacja konca wiersza '\n'. Polecenia wykonania ruchu wskazują ruch legalny.
-    Po poleceniu przerwania gry jest dowolny tekst, ignorowany przez program.
+    Po poleceniu przerwania gry jest dowolny tekst, ignorowany przez program
+    (z wyjatkiem trybu konca gry, patrz TRYB KONCA GRY).
 
     - Polecenie przerwania gry ma postac wiersza o tresci '='.
     - Polecenie rezygnacji z ruchu ma postac wiersza o tresci '-'.
@@ -57,11 +58,27 @@
     Nazwy są uporządkowane leksykograficznie. Kazda nazwa jest poprzedzona spacja.
     Nazwa pola to tak jak w przypadku wejscia cyfra od '1' do '8' poprzedzona mala litera
     od 'a' do 'h'.
+
+    TRYB ANALIZY:
+    Po uruchomieniu z argumentem '-g N' lub '-t MS' po nazwie kazdego pola w tekscie zachety
+    wypisywany jest dwukropek i ocena ruchu (patrz TRYB ANALIZY przed funkcja 'main').
+
+    TRYB KONCA GRY:
+    Po uruchomieniu z argumentem '-k' drugie odstepstwo od regul nie obowiazuje, gra konczy sie
+    wypisaniem liczby pionow graczy gdy zaden z nich nie ma legalnego ruchu. Tekst po wierszu '='
+    nie jest wtedy ignorowany: wejscie jest ciagiem partii zakonczonych wierszami '=', puste
+    wiersze sa pomijane, a inny wiersz nie bedacy poleceniem konczy prace programu
+    (patrz opis funkcji 'graj_z_koncem_gry').
 ***************************************************************************************************/
 
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 
 /**
@@ -592,12 +609,16 @@ void zmien_skos_w_prawo_w_dol(int wiersz, int kolumna, int gracz, int plansza[8]
 /**
     'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze z aktualnym stanem gry
     'gracz' - cyfra '0' lub '1' oznaczajaca pion gracza do ktorego nalezy tura
+    'ruchy' - tablica co najmniej 64 liczb, do ktorej zostana wpisane legalne ruchy
 
-    Wyswietla legalne ruchy gracza 'gracz' w porzadku leksykogfraficznym,
-    nazwa kazdego pola jest poprzedzona spacja
+    Wpisuje do tablicy 'ruchy' legalne ruchy gracza 'gracz' w porzadku leksykograficznym.
+    Ruch na pole 'wiersz' 'kolumna' jest zapisywany jako liczba 8 * wiersz + kolumna.
+    Zwraca liczbe legalnych ruchow.
 */
-void pokaz_mozliwe_ruchy(int plansza[8][8], int gracz)
-{   
+int znajdz_mozliwe_ruchy(int plansza[8][8], int gracz, int ruchy[64])
+{
+    int liczba_ruchow = 0;
+
     // przejscie w kolejnosci leksykograficznej przez pola planszy
     for (int j = 0; j < 8; j++)
     {
@@ -606,7 +627,7 @@ void pokaz_mozliwe_ruchy(int plansza[8][8], int gracz)
             // sprawdzenie czy pole jest puste
             if (plansza[i][j] == -1)
             {   
-                // wyswietlenie nazwy pola poprzedzonej spacja jesli ruch jest legalny
+                // zapamietanie pola jesli ruch jest legalny
                 if (sprawdz_pion_w_gore(i, j, gracz, plansza) ||
                     sprawdz_pion_w_dol(i, j, gracz, plansza) ||
                     sprawdz_poziom_w_lewo(i, j, gracz, plansza) ||
@@ -616,11 +637,64 @@ void pokaz_mozliwe_ruchy(int plansza[8][8], int gracz)
                     sprawdz_skos_w_prawo_w_dol(i, j, gracz, plansza) ||
                     sprawdz_skos_w_prawo_w_gore(i, j, gracz, plansza))
                 {
-                    printf(" %c%d", symbol_kolumny(j), i + 1);
+                    ruchy[liczba_ruchow] = 8 * i + j;
+                    liczba_ruchow++;
                 }
             }
         }
     }
+
+    return liczba_ruchow;
+}
+
+// rozmiar bufora wystarczajacy na ruchy tekstu zachety wraz z ocenami
+#define DLUGOSC_ZACHETY (64 * 16 + 1)
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze z aktualnym stanem gry
+    'gracz' - cyfra '0' lub '1' oznaczajaca pion gracza do ktorego nalezy tura
+    'oceny' - dwuwymiarowa tablica 8x8 z ocenami ruchow lub NULL gdy tryb analizy jest wylaczony
+    'tekst' - bufor na co najmniej 'DLUGOSC_ZACHETY' znakow
+
+    Zapisuje do bufora 'tekst' legalne ruchy gracza 'gracz' w porzadku leksykogfraficznym,
+    nazwa kazdego pola jest poprzedzona spacja. Jezeli podano tablice 'oceny',
+    po nazwie pola zapisywany jest dwukropek i ocena ruchu.
+*/
+void zapisz_mozliwe_ruchy(int plansza[8][8], int gracz, int oceny[8][8], char *tekst)
+{
+    int ruchy[64];
+    int liczba_ruchow = znajdz_mozliwe_ruchy(plansza, gracz, ruchy);
+    int dlugosc = 0;
+
+    tekst[0] = '\0';
+
+    for (int k = 0; k < liczba_ruchow; k++)
+    {
+        int i = ruchy[k] / 8;
+        int j = ruchy[k] % 8;
+
+        dlugosc += sprintf(tekst + dlugosc, " %c%d", symbol_kolumny(j), i + 1);
+
+        if (oceny != NULL)
+        {
+            dlugosc += sprintf(tekst + dlugosc, ":%d", oceny[i][j]);
+        }
+    }
+}
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze z aktualnym stanem gry
+    'gracz' - cyfra '0' lub '1' oznaczajaca pion gracza do ktorego nalezy tura
+    'oceny' - dwuwymiarowa tablica 8x8 z ocenami ruchow lub NULL gdy tryb analizy jest wylaczony
+
+    Wyswietla legalne ruchy gracza 'gracz' w postaci opisanej w 'zapisz_mozliwe_ruchy'.
+*/
+void pokaz_mozliwe_ruchy(int plansza[8][8], int gracz, int oceny[8][8])
+{   
+    char tekst[DLUGOSC_ZACHETY];
+
+    zapisz_mozliwe_ruchy(plansza, gracz, oceny, tekst);
+    fputs(tekst, stdout);
 }
 
 /**
@@ -673,72 +747,1634 @@ void wykonaj_ruch(int wiersz, int kolumna, int gracz, int plansza[8][8])
     }
 }
 
-int main(void)
-{   
-    // zmienna logiczna informujaca o kontynuacji gry
-    bool gra_trwa = true;
-    // informuje do ktorego gracza nalezy ruch
-    int tura = 0;
+/**
+    TRYB ANALIZY
+
+    Na potrzeby analizy plansza jest reprezentowana przez dwie liczby 64-bitowe
+    (tzw. bitboardy), po jednej dla pionow kazdego z graczy. Pole o wspolrzednych
+    'wiersz' 'kolumna' w tablicy 'plansza' odpowiada bitowi o numerze 8 * wiersz + kolumna.
+
+    Kazdy legalny ruch jest oceniany przeszukiwaniem alfa-beta o stalej glebokosci
+    lub ograniczonym czasie (iteracyjne poglebianie). Tablica transpozycji nie jest
+    czyszczona pomiedzy kolejnymi tekstami zachety: najlepsze ruchy zapisane w poprzednich
+    pozycjach poprawiaja kolejnosc przegladania ruchow. Zysk jest niewielki, okolo 4-6%
+    mniej odwiedzonych pozycji niz przy czyszczeniu tablicy przed kazda analiza.
+
+    Ocena jest podawana z punktu widzenia gracza do ktorego nalezy ruch.
+    W pozycjach koncowych (zaden z graczy nie ma legalnego ruchu) ocena to
+    roznica liczby pionow pomnozona przez 'WAGA_KONCA', w pozostalych
+    suma wag pol zajetych przez gracza pomniejszona o sume wag pol przeciwnika.
+*/
 
-    // symbole graczy do ktorych latwo mozna sie odwolac z uzyciem 'gracze['tura']'
-    char gracze[] = {'C', 'B'};
+#define KOLUMNA_A 0x0101010101010101ULL
+#define KOLUMNA_H 0x8080808080808080ULL
+
+#define NIESKONCZONOSC 1000000
+#define WAGA_KONCA 1000
+#define MAKS_GLEBOKOSC 60
+
+// liczba pozycji w tablicy transpozycji (potega dwojki)
+#define ROZMIAR_TABLICY (1 << 18)
+
+// co ile odwiedzonych pozycji sprawdzany jest limit czasu
+#define CO_ILE_ZEGAR 1024
+
+// rodzaje wartosci zapamietanych w tablicy transpozycji
+#define WARTOSC_DOKLADNA 0
+#define WARTOSC_DOLNA 1
+#define WARTOSC_GORNA 2
+
+// przesuniecia bitow odpowiadajace osmiu kierunkom na planszy
+static const int przesuniecia[8] = {1, -1, 8, -8, 9, 7, -7, -9};
+
+// maski usuwajace piony ktore po przesunieciu "przeskoczyly" na drugi brzeg planszy
+static const uint64_t maski_przesuniec[8] = {
+    ~KOLUMNA_A, ~KOLUMNA_H, ~0ULL, ~0ULL,
+    ~KOLUMNA_A, ~KOLUMNA_H, ~KOLUMNA_A, ~KOLUMNA_H
+};
+
+// wagi pol uzywane w ocenie pozycji niekoncowych
+static const int wagi_pol[64] = {
+    100, -20, 10,  5,  5, 10, -20, 100,
+    -20, -50, -2, -2, -2, -2, -50, -20,
+     10,  -2,  1,  1,  1,  1,  -2,  10,
+      5,  -2,  1,  0,  0,  1,  -2,   5,
+      5,  -2,  1,  0,  0,  1,  -2,   5,
+     10,  -2,  1,  1,  1,  1,  -2,  10,
+    -20, -50, -2, -2, -2, -2, -50, -20,
+    100, -20, 10,  5,  5, 10, -20, 100
+};
+
+typedef struct
+{
+    uint64_t gracz;
+    uint64_t przeciwnik;
+    int wartosc;
+    int8_t glebokosc;
+    int8_t najlepszy_ruch;
+    uint8_t rodzaj;
+    uint8_t pokolenie;
+} pozycja_w_tablicy;
+
+// tablica transpozycji wspoldzielona przez wszystkie kolejne analizy, rowniez pomiedzy
+// partiami w trybie konca gry (wpisy z innych pozycji sluza jedynie do ustalenia kolejnosci ruchow)
+static pozycja_w_tablicy tablica_transpozycji[ROZMIAR_TABLICY];
+
+// numer aktualnej analizy, pozwala zastepowac wpisy z poprzednich pozycji
+static uint8_t pokolenie = 0;
+
+// moment (w sekundach czasu rzeczywistego) w ktorym przeszukiwanie ma zostac przerwane
+// lub -1 gdy brak limitu
+static double koniec_czasu = -1;
+static bool przerwano = false;
+static unsigned long odwiedzone_pozycje = 0;
 
-    int plansza[8][8];
-    inicjalizuj_plansze(plansza);
+/**
+    Zwraca aktualny czas rzeczywisty w sekundach.
+*/
+static double sekundy(void)
+{
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;
+}
 
-    // liczba odpowiadajaca pierwszemu wprowadzonemu znakowi wedlug systemu ASCII
-    int wiersz_ascii;
-    // liczba odpowiadajaca drugiemu ewentualnie wprowadzonemu znakowi wedlug systemu ASCII
-    int kolumna_ascii;
-    // pierwsza wspolrzedna pola w tablicy 'plansza'
-    int wiersz;
-    // druga wspolrzedna pola w tablicy 'plansza'
-    int kolumna;
-    
-    while (gra_trwa)
-    {   
-        // wyswietlenie tekstu zachety
-        printf("%c", gracze[tura]);
-        pokaz_mozliwe_ruchy(plansza, tura);
-        printf("\n");
+/**
+    'plansza' - bitboard z pionami
+    'kierunek' - numer kierunku [0 - 7] z tablicy 'przesuniecia'
 
-        // zczytanie pierwszego znaku
-        kolumna_ascii = getchar();
-        
-        switch (kolumna_ascii)
+    Zwraca bitboard 'plansza' przesuniety o jedno pole w kierunku 'kierunek'.
+*/
+static uint64_t przesun(uint64_t plansza, int kierunek)
+{
+    int s = przesuniecia[kierunek];
+
+    if (s > 0)
+    {
+        return (plansza << s) & maski_przesuniec[kierunek];
+    }
+
+    return (plansza >> -s) & maski_przesuniec[kierunek];
+}
+
+/**
+    'gracz' - bitboard z pionami gracza do ktorego nalezy tura
+    'przeciwnik' - bitboard z pionami przeciwnika
+
+    Zwraca bitboard, w ktorym ustawione sa bity wszystkich pol
+    na ktorych gracz moze wykonac legalny ruch.
+*/
+static uint64_t ruchy_bitowe(uint64_t gracz, uint64_t przeciwnik)
+{
+    uint64_t puste = ~(gracz | przeciwnik);
+    uint64_t ruchy = 0;
+
+    for (int k = 0; k < 8; k++)
+    {
+        // linia pionow przeciwnika zaczynajaca sie przy pionie gracza (co najwyzej 6 pol)
+        uint64_t linia = przesun(gracz, k) & przeciwnik;
+
+        for (int i = 0; i < 5; i++)
         {
-            case '-': // rezygnacja z ruchu
-                break;
-            case '=': // przerwanie gry
-                gra_trwa = false;
-                break;
-            default: // zczytanie drugiego symobolu i wykonanie legalnego ruchu
+            linia |= przesun(linia, k) & przeciwnik;
+        }
 
-                /* 
-                    Konwersja zczytanego symbolu kolumny na odpowiadajacy mu numer
-                    kolumny w tablicy 'plansza' reprezentujacej plansze
-                */
-                kolumna = numer_kolumny((char) kolumna_ascii);
-                
+        ruchy |= przesun(linia, k) & puste;
+    }
 
-                /*
-                    Zczytanie i konwersja numeru wiersza na odpowiadajacy mu numer
-                    wiersza w tablicy 'plansza' reprezentujacej plansze
-                */
-                wiersz_ascii = getchar();
-                wiersz = numer_wiersza((char) wiersz_ascii);
+    return ruchy;
+}
 
-                wykonaj_ruch(wiersz, kolumna, tura, plansza);
-                
-                break;
+/**
+    'pole' - numer bitu [0 - 63] pustego pola na ktorym stawiany jest pion
+    'gracz' - bitboard z pionami gracza do ktorego nalezy tura
+    'przeciwnik' - bitboard z pionami przeciwnika
+
+    Zwraca bitboard pionow przeciwnika zmieniajacych kolor po ruchu gracza na pole 'pole'.
+*/
+static uint64_t zmieniane_piony(int pole, uint64_t gracz, uint64_t przeciwnik)
+{
+    uint64_t ruch = 1ULL << pole;
+    uint64_t zmienione = 0;
+
+    for (int k = 0; k < 8; k++)
+    {
+        uint64_t linia = 0;
+        uint64_t x = przesun(ruch, k);
+
+        // przejscie linii pionow przeciwnika
+        while (x & przeciwnik)
+        {
+            linia |= x;
+            x = przesun(x, k);
         }
-        
-        // zczytanie znaku reprezentujacego koniec wiersza
-        getchar();
 
-        // przekazanie ruchu nastepnemu graczowi
-        tura = 1 - tura;
+        // linia jest zmieniana tylko gdy bezposrednio za nia jest pion gracza
+        if (x & gracz)
+        {
+            zmienione |= linia;
+        }
     }
-    
-    return 0;
-}
\ No newline at end of file
+
+    return zmienione;
+}
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze z aktualnym stanem gry
+    'gracz' - cyfra '0' lub '1' oznaczajaca piony ktore maja zostac zapisane
+
+    Zwraca bitboard pionow gracza 'gracz' na planszy 'plansza'.
+*/
+static uint64_t do_bitboardu(int plansza[8][8], int gracz)
+{
+    uint64_t wynik = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            if (plansza[i][j] == gracz)
+            {
+                wynik |= 1ULL << (8 * i + j);
+            }
+        }
+    }
+
+    return wynik;
+}
+
+/**
+    'maska' - bitboard z legalnymi ruchami gracza
+    'tekst' - bufor na co najmniej 'DLUGOSC_ZACHETY' znakow
+
+    Zapisuje do bufora 'tekst' pola ustawione w 'maska' w porzadku leksykograficznym,
+    w tym samym formacie co 'zapisz_mozliwe_ruchy' bez ocen.
+*/
+void zapisz_ruchy_bitowe(uint64_t maska, char *tekst)
+{
+    int dlugosc = 0;
+
+    tekst[0] = '\0';
+
+    for (int j = 0; j < 8; j++)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            if (maska >> (8 * i + j) & 1)
+            {
+                dlugosc += sprintf(tekst + dlugosc, " %c%d", symbol_kolumny(j), i + 1);
+            }
+        }
+    }
+}
+
+/**
+    Zwraca indeks pozycji w tablicy transpozycji (mieszanie typu splitmix64).
+*/
+static uint64_t klucz_pozycji(uint64_t gracz, uint64_t przeciwnik)
+{
+    uint64_t h = gracz * 0x9E3779B97F4A7C15ULL ^ (przeciwnik + 0x632BE59BD9B4E019ULL);
+
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+
+    return h & (ROZMIAR_TABLICY - 1);
+}
+
+/**
+    Zwraca ocene pozycji z punktu widzenia gracza 'gracz' gdy gra nie jest zakonczona.
+*/
+static int ocen_pozycje(uint64_t gracz, uint64_t przeciwnik)
+{
+    int wynik = 0;
+
+    for (int i = 0; i < 64; i++)
+    {
+        if (gracz >> i & 1)
+        {
+            wynik += wagi_pol[i];
+        }
+        else if (przeciwnik >> i & 1)
+        {
+            wynik -= wagi_pol[i];
+        }
+    }
+
+    return wynik;
+}
+
+/**
+    Zwraca ocene zakonczonej gry z punktu widzenia gracza 'gracz'.
+*/
+static int ocen_koniec(uint64_t gracz, uint64_t przeciwnik)
+{
+    return WAGA_KONCA * (__builtin_popcountll(gracz) - __builtin_popcountll(przeciwnik));
+}
+
+/**
+    'gracz' - bitboard z pionami gracza do ktorego nalezy tura
+    'przeciwnik' - bitboard z pionami przeciwnika
+    'glebokosc' - liczba posuniec do przeszukania
+    'alfa', 'beta' - okno przeszukiwania
+
+    Przeszukiwanie negamax z odcieciami alfa-beta i tablica transpozycji.
+    Zwraca ocene pozycji z punktu widzenia gracza 'gracz'. Jezeli przekroczono
+    limit czasu ustawia 'przerwano' i zwraca wartosc bez znaczenia.
+*/
+static int szukaj(uint64_t gracz, uint64_t przeciwnik, int glebokosc, int alfa, int beta)
+{
+    // okresowe sprawdzenie limitu czasu
+    if (++odwiedzone_pozycje % CO_ILE_ZEGAR == 0 && koniec_czasu != -1 && sekundy() >= koniec_czasu)
+    {
+        przerwano = true;
+    }
+    if (przerwano)
+    {
+        return 0;
+    }
+
+    uint64_t ruchy = ruchy_bitowe(gracz, przeciwnik);
+
+    if (ruchy == 0)
+    {
+        // zaden z graczy nie ma ruchu - koniec gry
+        if (ruchy_bitowe(przeciwnik, gracz) == 0)
+        {
+            return ocen_koniec(gracz, przeciwnik);
+        }
+
+        // pas, ruch przechodzi na przeciwnika
+        return -szukaj(przeciwnik, gracz, glebokosc, -beta, -alfa);
+    }
+
+    if (glebokosc == 0)
+    {
+        return ocen_pozycje(gracz, przeciwnik);
+    }
+
+    // odczytanie tablicy transpozycji
+    pozycja_w_tablicy *wpis = &tablica_transpozycji[klucz_pozycji(gracz, przeciwnik)];
+    int najlepszy_ruch = -1;
+
+    if (wpis->gracz == gracz && wpis->przeciwnik == przeciwnik)
+    {
+        // wartosci z poprzednich analiz pochodza z przeszukiwan o innej glebokosci calkowitej,
+        // ich uzycie do odciec zaburza przeszukiwanie, wiec sluza jedynie do ustalenia kolejnosci ruchow
+        if (wpis->glebokosc >= glebokosc && wpis->pokolenie == pokolenie)
+        {
+            if (wpis->rodzaj == WARTOSC_DOKLADNA ||
+                (wpis->rodzaj == WARTOSC_DOLNA && wpis->wartosc >= beta) ||
+                (wpis->rodzaj == WARTOSC_GORNA && wpis->wartosc <= alfa))
+            {
+                return wpis->wartosc;
+            }
+        }
+
+        najlepszy_ruch = wpis->najlepszy_ruch;
+    }
+
+    int poczatkowa_alfa = alfa;
+    int najlepsza_wartosc = -NIESKONCZONOSC;
+    int ruch_najlepszej_wartosci = -1;
+
+    // najlepszy ruch z tablicy transpozycji jest sprawdzany jako pierwszy
+    if (najlepszy_ruch >= 0 && (ruchy >> najlepszy_ruch & 1))
+    {
+        ruchy &= ~(1ULL << najlepszy_ruch);
+    }
+    else
+    {
+        najlepszy_ruch = -1;
+    }
+
+    while (najlepszy_ruch >= 0 || ruchy != 0)
+    {
+        int pole;
+
+        if (najlepszy_ruch >= 0)
+        {
+            pole = najlepszy_ruch;
+            najlepszy_ruch = -1;
+        }
+        else
+        {
+            pole = __builtin_ctzll(ruchy);
+            ruchy &= ruchy - 1;
+        }
+
+        uint64_t zmienione = zmieniane_piony(pole, gracz, przeciwnik);
+        int wartosc = -szukaj(przeciwnik ^ zmienione, gracz | zmienione | (1ULL << pole),
+                              glebokosc - 1, -beta, -alfa);
+
+        if (przerwano)
+        {
+            return 0;
+        }
+
+        if (wartosc > najlepsza_wartosc)
+        {
+            najlepsza_wartosc = wartosc;
+            ruch_najlepszej_wartosci = pole;
+        }
+        if (wartosc > alfa)
+        {
+            alfa = wartosc;
+        }
+        if (alfa >= beta)
+        {
+            break;
+        }
+    }
+
+    // zapis do tablicy transpozycji, wpisy z poprzednich analiz sa zawsze zastepowane
+    if (wpis->pokolenie != pokolenie || wpis->glebokosc <= glebokosc)
+    {
+        wpis->gracz = gracz;
+        wpis->przeciwnik = przeciwnik;
+        wpis->wartosc = najlepsza_wartosc;
+        wpis->glebokosc = (int8_t) glebokosc;
+        wpis->najlepszy_ruch = (int8_t) ruch_najlepszej_wartosci;
+        wpis->pokolenie = pokolenie;
+
+        if (najlepsza_wartosc <= poczatkowa_alfa)
+        {
+            wpis->rodzaj = WARTOSC_GORNA;
+        }
+        else if (najlepsza_wartosc >= beta)
+        {
+            wpis->rodzaj = WARTOSC_DOLNA;
+        }
+        else
+        {
+            wpis->rodzaj = WARTOSC_DOKLADNA;
+        }
+    }
+
+    return najlepsza_wartosc;
+}
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze z aktualnym stanem gry
+    'gracz' - cyfra '0' lub '1' oznaczajaca pion gracza do ktorego nalezy tura
+    'glebokosc' - maksymalna glebokosc przeszukiwania
+    'limit_ms' - limit czasu analizy w milisekundach lub '0' gdy brak limitu
+    'oceny' - dwuwymiarowa tablica 8x8 do ktorej zostana wpisane oceny ruchow
+
+    Wpisuje do tablicy 'oceny' ocene kazdego legalnego ruchu gracza 'gracz'.
+    Glebokosc jest zwiekszana od 1 do 'glebokosc'; jezeli limit czasu (liczony w czasie
+    rzeczywistym od wywolania funkcji) skonczy sie w trakcie iteracji, zachowywane sa
+    oceny z ostatniej ukonczonej iteracji. Pierwsza iteracja jest zawsze wykonywana
+    do konca, aby kazdy ruch mial ocene.
+*/
+void analizuj_pozycje(int plansza[8][8], int gracz, int glebokosc, int limit_ms, int oceny[8][8])
+{
+    uint64_t moje = do_bitboardu(plansza, gracz);
+    uint64_t jego = do_bitboardu(plansza, 1 - gracz);
+    uint64_t ruchy = ruchy_bitowe(moje, jego);
+    int nowe_oceny[64];
+    double termin = sekundy() + limit_ms / 1000.0;
+
+    pokolenie++;
+    przerwano = false;
+    koniec_czasu = -1;
+
+    for (int g = 1; g <= glebokosc; g++)
+    {
+        // limit czasu jest sprawdzany dopiero od drugiej iteracji
+        if (g == 2 && limit_ms > 0)
+        {
+            koniec_czasu = termin;
+        }
+
+        for (uint64_t r = ruchy; r != 0 && !przerwano; r &= r - 1)
+        {
+            int pole = __builtin_ctzll(r);
+            uint64_t zmienione = zmieniane_piony(pole, moje, jego);
+
+            nowe_oceny[pole] = -szukaj(jego ^ zmienione, moje | zmienione | (1ULL << pole),
+                                       g - 1, -NIESKONCZONOSC, NIESKONCZONOSC);
+        }
+
+        if (przerwano)
+        {
+            break;
+        }
+
+        for (uint64_t r = ruchy; r != 0; r &= r - 1)
+        {
+            int pole = __builtin_ctzll(r);
+            oceny[pole / 8][pole % 8] = nowe_oceny[pole];
+        }
+
+        // dalsze poglebianie nie zmieni ocen gdy plansza zostanie zapelniona
+        if (g >= 64 - __builtin_popcountll(moje | jego))
+        {
+            break;
+        }
+    }
+}
+
+#ifndef POMIAR
+
+/*
+    Funkcje trybu konca gry (patrz 'graj_z_koncem_gry'), uzywane rowniez w trybie weryfikacji.
+*/
+
+// rodzaje polecen rozpoznawanych w trybie konca gry
+#define POLECENIE_RUCH 0
+#define POLECENIE_PAS 1
+#define POLECENIE_KONIEC_PARTII 2
+#define POLECENIE_KONIEC_WEJSCIA 3
+
+// rozmiar bufora na jeden wiersz wejscia w trybie konca gry
+#define DLUGOSC_WIERSZA 8
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 reprezentujaca plansze
+    'piony' - bitboardy z pionami gracza czarnego i bialego
+    'maski' - bitboardy z legalnymi ruchami gracza czarnego i bialego
+
+    Ustawia 'plansza', 'piony' i 'maski' w pozycji poczatkowej gry.
+*/
+static void rozpocznij_partie(int plansza[8][8], uint64_t piony[2], uint64_t maski[2])
+{
+    inicjalizuj_plansze(plansza);
+    piony[0] = do_bitboardu(plansza, 0);
+    piony[1] = do_bitboardu(plansza, 1);
+    maski[0] = ruchy_bitowe(piony[0], piony[1]);
+    maski[1] = ruchy_bitowe(piony[1], piony[0]);
+}
+
+/**
+    'wiersz' - bufor na 'DLUGOSC_WIERSZA' znakow
+    'wejscie' - strumien, z ktorego czytany jest wiersz
+
+    Wczytuje do bufora 'wiersz' jeden wiersz wejscia bez znaku konca wiersza
+    (rowniez bez poprzedzajacego go znaku '\r' z konca wiersza w stylu Windows).
+    Wiersz dluzszy niz bufor jest wczytywany do konca i zastepowany tekstem "?",
+    ktory nie jest zadnym poleceniem. Zwraca 'false' gdy wejscie sie skonczylo.
+*/
+static bool wczytaj_wiersz(char wiersz[DLUGOSC_WIERSZA], FILE *wejscie)
+{
+    if (fgets(wiersz, DLUGOSC_WIERSZA, wejscie) == NULL)
+    {
+        return false;
+    }
+
+    size_t dlugosc = strlen(wiersz);
+
+    if (dlugosc > 0 && wiersz[dlugosc - 1] == '\n')
+    {
+        wiersz[--dlugosc] = '\0';
+
+        if (dlugosc > 0 && wiersz[dlugosc - 1] == '\r')
+        {
+            wiersz[--dlugosc] = '\0';
+        }
+    }
+    else if (!feof(wejscie))
+    {
+        // zczytanie reszty zbyt dlugiego wiersza
+        int znak;
+        while ((znak = getc(wejscie)) != EOF && znak != '\n')
+        {
+        }
+
+        strcpy(wiersz, "?");
+    }
+
+    return true;
+}
+
+/**
+    Zwraca wartosc logiczna informujaca czy 'wiersz' sklada sie jedynie z bialych znakow.
+*/
+static bool pusty_wiersz(const char *wiersz)
+{
+    for (size_t i = 0; wiersz[i] != '\0'; i++)
+    {
+        if (wiersz[i] != ' ' && wiersz[i] != '\t')
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+    'wiersz' - bufor na 'DLUGOSC_WIERSZA' znakow
+    'wejscie' - strumien, z ktorego czytane sa wiersze
+
+    Wczytuje do bufora 'wiersz' pierwszy wiersz wejscia, ktory nie sklada sie jedynie
+    z bialych znakow. Zwraca 'false' gdy wejscie sie skonczylo.
+*/
+static bool wczytaj_polecenie(char wiersz[DLUGOSC_WIERSZA], FILE *wejscie)
+{
+    do
+    {
+        if (!wczytaj_wiersz(wiersz, wejscie))
+        {
+            return false;
+        }
+    } while (pusty_wiersz(wiersz));
+
+    return true;
+}
+
+/**
+    'wiersz' - wiersz wejscia bez znaku konca wiersza
+    'pole' - miejsce na numer bitu [0 - 63] pola wskazanego przez polecenie ruchu
+
+    Zwraca rodzaj polecenia zapisanego w wierszu 'wiersz'. Wiersz, ktory nie jest
+    poleceniem '-', '=' ani nazwa pola, jest traktowany jak koniec wejscia.
+*/
+static int rozpoznaj_polecenie(const char *wiersz, int *pole)
+{
+    if (strcmp(wiersz, "-") == 0)
+    {
+        return POLECENIE_PAS;
+    }
+    if (strcmp(wiersz, "=") == 0)
+    {
+        return POLECENIE_KONIEC_PARTII;
+    }
+
+    // sprawdzenie czy wiersz jest poprawna nazwa pola
+    if (strlen(wiersz) == 2 && numer_kolumny(wiersz[0]) != -1 && wiersz[1] >= '1' && wiersz[1] <= '8')
+    {
+        *pole = 8 * numer_wiersza(wiersz[1]) + numer_kolumny(wiersz[0]);
+        return POLECENIE_RUCH;
+    }
+
+    return POLECENIE_KONIEC_WEJSCIA;
+}
+
+/**
+    'wejscie', 'wyjscie' - strumienie polecen i tekstow zachety (w programie 'stdin' i 'stdout')
+    'analiza' - czy wypisywac oceny ruchow (patrz TRYB ANALIZY)
+    'glebokosc_analizy', 'limit_analizy_ms' - parametry przekazywane do 'analizuj_pozycje'
+
+    Petla programu w trybie konca gry. Wejscie jest ciagiem partii zakonczonych wierszem '=',
+    puste wiersze sa pomijane w kazdym miejscu wejscia, a kazdy inny wiersz nie bedacy
+    poleceniem konczy prace.
+
+    Maski legalnych ruchow obu graczy sa wyznaczane po kazdym ruchu (rezygnacja z ruchu
+    ich nie zmienia), wiec koniec gry jest wykrywany sprawdzeniem czy obie maski sa puste
+    (dotyczy to rowniez zapelnionej planszy). Wtedy zamiast tekstu zachety wypisywany jest
+    wiersz 'KONIEC C x B y' z liczbami pionow graczy, a polecenia do wiersza '=' sa pomijane.
+    Poza trybem analizy tekst zachety jest tworzony z maski ruchow.
+*/
+void graj_z_koncem_gry(FILE *wejscie, FILE *wyjscie, bool analiza, int glebokosc_analizy,
+                       int limit_analizy_ms)
+{
+    char gracze[] = {'C', 'B'};
+    char wiersz[DLUGOSC_WIERSZA];
+    char tekst[DLUGOSC_ZACHETY];
+    int oceny[8][8];
+
+    // plansza jest uaktualniana tylko w trybie analizy, ktory z niej korzysta
+    int plansza[8][8];
+    uint64_t piony[2];
+    uint64_t maski[2];
+
+    // petla po kolejnych partiach
+    while (true)
+    {
+        int pole;
+
+        // pierwszy wiersz partii jest wczytywany przed jej rozpoczeciem, aby po ostatniej
+        // partii (koniec pliku lub wiersz nie bedacy poleceniem) nie wypisac tekstu zachety
+        if (!wczytaj_polecenie(wiersz, wejscie) || rozpoznaj_polecenie(wiersz, &pole) == POLECENIE_KONIEC_WEJSCIA)
+        {
+            return;
+        }
+
+        bool wiersz_wczytany = true;
+        bool partia_trwa = true;
+        int tura = 0;
+
+        rozpocznij_partie(plansza, piony, maski);
+
+        while (partia_trwa)
+        {
+            if (maski[0] == 0 && maski[1] == 0)
+            {
+                fprintf(wyjscie, "KONIEC C %d B %d\n",
+                        __builtin_popcountll(piony[0]), __builtin_popcountll(piony[1]));
+
+                // pominiecie polecen pozostalych do konca partii
+                while (true)
+                {
+                    if (!wiersz_wczytany && !wczytaj_polecenie(wiersz, wejscie))
+                    {
+                        return;
+                    }
+                    wiersz_wczytany = false;
+
+                    int polecenie = rozpoznaj_polecenie(wiersz, &pole);
+
+                    if (polecenie == POLECENIE_KONIEC_WEJSCIA)
+                    {
+                        return;
+                    }
+                    if (polecenie == POLECENIE_KONIEC_PARTII)
+                    {
+                        break;
+                    }
+                }
+
+                break;
+            }
+
+            // wyswietlenie tekstu zachety
+            if (analiza)
+            {
+                analizuj_pozycje(plansza, tura, glebokosc_analizy, limit_analizy_ms, oceny);
+                zapisz_mozliwe_ruchy(plansza, tura, oceny, tekst);
+            }
+            else
+            {
+                zapisz_ruchy_bitowe(maski[tura], tekst);
+            }
+            fprintf(wyjscie, "%c%s\n", gracze[tura], tekst);
+
+            if (!wiersz_wczytany && !wczytaj_polecenie(wiersz, wejscie))
+            {
+                return;
+            }
+            wiersz_wczytany = false;
+
+            switch (rozpoznaj_polecenie(wiersz, &pole))
+            {
+                case POLECENIE_PAS:
+                    break;
+                case POLECENIE_KONIEC_PARTII:
+                    partia_trwa = false;
+                    break;
+                case POLECENIE_KONIEC_WEJSCIA:
+                    return;
+                default: // wykonanie ruchu i uaktualnienie masek ruchow
+                {
+                    uint64_t zmienione = zmieniane_piony(pole, piony[tura], piony[1 - tura]);
+
+                    piony[tura] |= zmienione | (1ULL << pole);
+                    piony[1 - tura] ^= zmienione;
+                    maski[0] = ruchy_bitowe(piony[0], piony[1]);
+                    maski[1] = ruchy_bitowe(piony[1], piony[0]);
+
+                    if (analiza)
+                    {
+                        wykonaj_ruch(pole / 8, pole % 8, tura, plansza);
+                    }
+                    break;
+                }
+            }
+
+            // przekazanie ruchu nastepnemu graczowi
+            tura = 1 - tura;
+        }
+    }
+}
+
+#endif
+
+#ifdef WERYFIKACJA
+
+/**
+    TRYB WERYFIKACJI (kompilacja z -DWERYFIKACJA)
+
+    Porownuje silnik bitowy (ruchy_bitowe, zmieniane_piony) z implementacja wzorcowa
+    (sprawdz_X, zmien_X, wykonaj_ruch) na tych samych poleceniach. Wejsciem jest tekst
+    czytany wierszami tak jak w trybie konca gry ('wczytaj_polecenie', 'rozpoznaj_polecenie'):
+    '-' oznacza rezygnacje z ruchu, '=' rozpoczyna nowa partie, nazwa pola wskazuje ruch,
+    a inny wiersz konczy wejscie. Ruch jest wykonywany tylko wtedy, gdy jest legalny w obu
+    silnikach, ruch nielegalny w obu jest pomijany (nie spelnia warunkow z naglowka pliku).
+    Po kazdym poleceniu porownywane sa teksty zachety obu silnikow oraz plansze. Tekst
+    zachety implementacji wzorcowej pochodzi z 'zapisz_mozliwe_ruchy' (ten sam kod co
+    wypisywany przez 'pokaz_mozliwe_ruchy'), a tekst silnika bitowego jest tworzony z maski
+    ruchow w tym samym formacie. Petla trybu konca gry jest sprawdzana osobno (patrz
+    'sprawdz_tryb_konca_gry'), sama petla 'main' (wczytywanie znakow funkcja getchar)
+    nie jest sprawdzana. Obowiazuja odstepstwa od regul z naglowka pliku: rezygnacja
+    z ruchu jest dozwolona mimo istnienia legalnego ruchu, a gra nie konczy sie gdy zaden
+    z graczy nie ma ruchu.
+
+    Przy niezgodnosci wypisuje opis na standardowe wyjscie bledow i przerywa program
+    funkcja abort(), co pozwala wykryc blad zarowno w petli losowej jak i w libFuzzerze.
+*/
+
+/**
+    'plansza' - dwuwymiarowa tablica 8x8 z pozycja wedlug implementacji wzorcowej
+    'tekst' - bufor na co najmniej 65 znakow
+
+    Zapisuje do bufora 'tekst' plansze w postaci 64 znakow 'C', 'B' lub '.' w kolejnosci wierszy.
+*/
+static void zapisz_plansze(int plansza[8][8], char *tekst)
+{
+    for (int i = 0; i < 64; i++)
+    {
+        tekst[i] = plansza[i / 8][i % 8] == -1 ? '.' : "CB"[plansza[i / 8][i % 8]];
+    }
+
+    tekst[64] = '\0';
+}
+
+/**
+    Wypisuje opis niezgodnosci silnikow w posunieciu 'posuniecie' i przerywa program.
+*/
+static void zglos_niezgodnosc(const char *opis, size_t posuniecie, int plansza[8][8])
+{
+    char tekst[65];
+
+    zapisz_plansze(plansza, tekst);
+    fprintf(stderr, "NIEZGODNOSC (%s) w posunieciu %zu, plansza wzorcowa: %s\n",
+            opis, posuniecie, tekst);
+    abort();
+}
+
+/**
+    Zwraca nowy plik tymczasowy, a gdy nie mozna go utworzyc konczy program.
+*/
+static FILE *plik_tymczasowy(void)
+{
+    FILE *plik = tmpfile();
+
+    if (plik == NULL)
+    {
+        fprintf(stderr, "Nie mozna utworzyc pliku tymczasowego\n");
+        exit(1);
+    }
+
+    return plik;
+}
+
+/**
+    'wejscie' - strumien z poleceniami graczy
+
+    Rozgrywa partie zapisane w 'wejscie' rownolegle w obu silnikach i porownuje je
+    po kazdym poleceniu.
+*/
+static void rozegraj_weryfikacje(FILE *wejscie)
+{
+    char wiersz[DLUGOSC_WIERSZA];
+    int plansza[8][8];
+    inicjalizuj_plansze(plansza);
+
+    // piony obu graczy wedlug silnika bitowego
+    uint64_t piony[2] = {do_bitboardu(plansza, 0), do_bitboardu(plansza, 1)};
+    int tura = 0;
+
+    for (size_t p = 0; ; p++)
+    {
+        // porownanie tekstow zachety (ruchy bitowe wypisywane w kolejnosci leksykograficznej)
+        char tekst_wzorcowy[DLUGOSC_ZACHETY];
+        char tekst_bitowy[DLUGOSC_ZACHETY];
+        uint64_t maska = ruchy_bitowe(piony[tura], piony[1 - tura]);
+
+        zapisz_mozliwe_ruchy(plansza, tura, NULL, tekst_wzorcowy);
+        zapisz_ruchy_bitowe(maska, tekst_bitowy);
+
+        if (strcmp(tekst_wzorcowy, tekst_bitowy) != 0)
+        {
+            zglos_niezgodnosc("tekst zachety", p, plansza);
+        }
+
+        if (!wczytaj_polecenie(wiersz, wejscie))
+        {
+            return;
+        }
+
+        int pole;
+
+        switch (rozpoznaj_polecenie(wiersz, &pole))
+        {
+            case POLECENIE_PAS:
+                tura = 1 - tura;
+                break;
+            case POLECENIE_KONIEC_PARTII:
+                inicjalizuj_plansze(plansza);
+                piony[0] = do_bitboardu(plansza, 0);
+                piony[1] = do_bitboardu(plansza, 1);
+                tura = 0;
+                break;
+            case POLECENIE_KONIEC_WEJSCIA:
+                return;
+            default: // wykonanie ruchu w obu silnikach, o ile jest w nich legalny
+            {
+                int ruchy[64];
+                int liczba_ruchow = znajdz_mozliwe_ruchy(plansza, tura, ruchy);
+                bool legalny_wzorcowo = false;
+                bool legalny_bitowo = (maska >> pole) & 1;
+
+                for (int i = 0; i < liczba_ruchow; i++)
+                {
+                    legalny_wzorcowo |= ruchy[i] == pole;
+                }
+
+                if (legalny_wzorcowo != legalny_bitowo)
+                {
+                    zglos_niezgodnosc("legalnosc ruchu", p, plansza);
+                }
+
+                if (legalny_wzorcowo)
+                {
+                    uint64_t zmienione = zmieniane_piony(pole, piony[tura], piony[1 - tura]);
+
+                    wykonaj_ruch(pole / 8, pole % 8, tura, plansza);
+
+                    piony[tura] |= zmienione | (1ULL << pole);
+                    piony[1 - tura] ^= zmienione;
+                    tura = 1 - tura;
+                }
+                break;
+            }
+        }
+
+        // porownanie plansz
+        if (do_bitboardu(plansza, 0) != piony[0] || do_bitboardu(plansza, 1) != piony[1])
+        {
+            zglos_niezgodnosc("plansza", p, plansza);
+        }
+    }
+}
+
+/**
+    Punkt wejscia dla libFuzzera (kompilacja z -DWERYFIKACJA -DWERYFIKACJA_LIBFUZZER
+    -fsanitize=fuzzer), dane wejsciowe sa tekstem polecen dla 'rozegraj_weryfikacje'.
+*/
+int LLVMFuzzerTestOneInput(const uint8_t *dane, size_t rozmiar)
+{
+    FILE *wejscie = plik_tymczasowy();
+
+    fwrite(dane, 1, rozmiar, wejscie);
+    rewind(wejscie);
+    rozegraj_weryfikacje(wejscie);
+    fclose(wejscie);
+
+    return 0;
+}
+
+#ifndef WERYFIKACJA_LIBFUZZER
+
+// liczba polecen w jednej losowej partii, wiecej niz potrzeba do zapelnienia planszy
+#define POLECENIA_W_PARTII 128
+// liczba partii w jednym wejsciu sprawdzanym w trybie konca gry
+#define PARTIE_W_PACZCE 50
+
+/**
+    'stan' - stan generatora xorshift64, rozny od zera
+
+    Zwraca kolejna liczbe pseudolosowa.
+*/
+static uint64_t losuj(uint64_t *stan)
+{
+    *stan ^= *stan << 13;
+    *stan ^= *stan >> 7;
+    *stan ^= *stan << 17;
+
+    return *stan;
+}
+
+/**
+    'plik' - strumien, do ktorego dopisywany jest wiersz
+    'tekst' - tresc wiersza
+    'stan' - stan generatora liczb pseudolosowych
+
+    Dopisuje do 'plik' wiersz 'tekst' zakonczony losowo znakiem '\n' lub para '\r\n',
+    czasem poprzedzony wierszem pustym lub zlozonym z bialych znakow.
+*/
+static void dopisz_wiersz(FILE *plik, const char *tekst, uint64_t *stan)
+{
+    uint64_t los = losuj(stan);
+
+    if (los % 8 == 0)
+    {
+        fputs(los % 16 == 0 ? "\n" : " \t\n", plik);
+    }
+
+    fprintf(plik, "%s%s", tekst, (los >> 8) % 4 == 0 ? "\r\n" : "\n");
+}
+
+/**
+    'plik' - strumien, do ktorego zapisywane sa polecenia
+    'stan' - stan generatora liczb pseudolosowych
+    'liczba_partii' - liczba partii do zapisania
+
+    Zapisuje do 'plik' tekst polecen 'liczba_partii' losowych partii rozdzielonych wierszami
+    '=', kazda z 'POLECENIA_W_PARTII' polecen (chyba ze zostanie wczesniej przerwana).
+    Wiekszosc polecen to losowe legalne ruchy wedlug implementacji wzorcowej, reszta to
+    rezygnacje z ruchu i nazwy losowych pol, zwykle nielegalne. Wejscie zawiera tez puste
+    wiersze i konce wierszy '\r\n', a konczy sie koncem pliku lub wierszem nie bedacym
+    poleceniem.
+*/
+static void zapisz_losowe_polecenia(FILE *plik, uint64_t *stan, int liczba_partii)
+{
+    int plansza[8][8];
+    int ruchy[64];
+
+    for (int g = 0; g < liczba_partii; g++)
+    {
+        int tura = 0;
+        inicjalizuj_plansze(plansza);
+
+        for (int p = 0; p < POLECENIA_W_PARTII; p++)
+        {
+            int liczba_ruchow = znajdz_mozliwe_ruchy(plansza, tura, ruchy);
+            uint64_t los = losuj(stan);
+
+            // przerwanie partii w trakcie gry
+            if (los % 512 == 0)
+            {
+                break;
+            }
+
+            if (liczba_ruchow == 0 || (los >> 16) % 16 == 15)
+            {
+                dopisz_wiersz(plik, "-", stan);
+                tura = 1 - tura;
+                continue;
+            }
+
+            // ruch legalny albo, rzadziej, dowolne pole
+            int pole = (los >> 16) % 16 == 14 ? (int) ((los >> 32) % 64)
+                                                : ruchy[(los >> 32) % liczba_ruchow];
+            char polecenie[3] = {symbol_kolumny(pole % 8), (char) ('1' + pole / 8), '\0'};
+
+            dopisz_wiersz(plik, polecenie, stan);
+
+            for (int i = 0; i < liczba_ruchow; i++)
+            {
+                if (ruchy[i] == pole)
+                {
+                    wykonaj_ruch(pole / 8, pole % 8, tura, plansza);
+                    tura = 1 - tura;
+                    break;
+                }
+            }
+        }
+
+        dopisz_wiersz(plik, "=", stan);
+    }
+
+    if (losuj(stan) % 2 == 0)
+    {
+        dopisz_wiersz(plik, "koniec", stan);
+    }
+}
+
+/**
+    'stan' - stan generatora liczb pseudolosowych
+    'liczba_partii' - liczba partii zapisywanych w jednym wejsciu
+
+    Sprawdza petle trybu konca gry ('graj_z_koncem_gry'). Implementacja wzorcowa rozgrywa
+    losowe partie, zapisujac polecenia graczy jako jedno wejscie (partie rozdzielone
+    wierszami '=') oraz oczekiwane wyjscie: teksty zachety z 'zapisz_mozliwe_ruchy'
+    i wiersz 'KONIEC C x B y' z liczbami pionow na planszy wzorcowej, gdy zaden z graczy
+    nie ma legalnego ruchu. Wiekszosc partii jest rozgrywana do tego momentu i po nim
+    zawiera polecenia, ktore program ma pominac, a czesc jest przerywana wierszem '='
+    w trakcie gry. Wejscie zawiera puste wiersze i konce wierszy '\r\n', a konczy sie
+    koncem pliku lub wierszem nie bedacym poleceniem.
+
+    Wyjscie 'graj_z_koncem_gry' musi byc identyczne z oczekiwanym, w szczegolnosci liczby
+    pionow wyznaczone z bitboardow musza byc rowne liczbom pionow na planszy wzorcowej.
+*/
+static void sprawdz_tryb_konca_gry(uint64_t *stan, int liczba_partii)
+{
+    FILE *wejscie = plik_tymczasowy();
+    FILE *oczekiwane = plik_tymczasowy();
+    FILE *wyjscie = plik_tymczasowy();
+
+    char gracze[] = {'C', 'B'};
+    char tekst[DLUGOSC_ZACHETY];
+    int plansza[8][8];
+    int ruchy[64];
+
+    for (int g = 0; g < liczba_partii; g++)
+    {
+        int tura = 0;
+        inicjalizuj_plansze(plansza);
+
+        while (true)
+        {
+            int liczba_ruchow = znajdz_mozliwe_ruchy(plansza, tura, ruchy);
+
+            if (liczba_ruchow == 0 && znajdz_mozliwe_ruchy(plansza, 1 - tura, ruchy) == 0)
+            {
+                int liczba_pionow[2] = {0, 0};
+
+                for (int i = 0; i < 64; i++)
+                {
+                    if (plansza[i / 8][i % 8] != -1)
+                    {
+                        liczba_pionow[plansza[i / 8][i % 8]]++;
+                    }
+                }
+
+                fprintf(oczekiwane, "KONIEC C %d B %d\n", liczba_pionow[0], liczba_pionow[1]);
+
+                // polecenia po koncu gry, ktore program ma pominac
+                for (uint64_t n = losuj(stan) % 4; n > 0; n--)
+                {
+                    dopisz_wiersz(wejscie, losuj(stan) % 2 == 0 ? "-" : "a1", stan);
+                }
+
+                break;
+            }
+
+            zapisz_mozliwe_ruchy(plansza, tura, NULL, tekst);
+            fprintf(oczekiwane, "%c%s\n", gracze[tura], tekst);
+
+            uint64_t los = losuj(stan);
+
+            // przerwanie partii w trakcie gry
+            if (los % 512 == 0)
+            {
+                break;
+            }
+
+            if (liczba_ruchow == 0 || (los >> 16) % 16 == 0)
+            {
+                dopisz_wiersz(wejscie, "-", stan);
+            }
+            else
+            {
+                int pole = ruchy[(los >> 32) % liczba_ruchow];
+                char polecenie[3] = {symbol_kolumny(pole % 8), (char) ('1' + pole / 8), '\0'};
+
+                dopisz_wiersz(wejscie, polecenie, stan);
+                wykonaj_ruch(pole / 8, pole % 8, tura, plansza);
+            }
+
+            tura = 1 - tura;
+        }
+
+        dopisz_wiersz(wejscie, "=", stan);
+    }
+
+    if (losuj(stan) % 2 == 0)
+    {
+        dopisz_wiersz(wejscie, "koniec", stan);
+    }
+
+    rewind(wejscie);
+    graj_z_koncem_gry(wejscie, wyjscie, false, 0, 0);
+
+    // porownanie wyjscia programu z oczekiwanym
+    rewind(oczekiwane);
+    rewind(wyjscie);
+
+    int znak;
+    int numer_wiersza_wyjscia = 1;
+
+    do
+    {
+        znak = getc(oczekiwane);
+
+        if (getc(wyjscie) != znak)
+        {
+            fprintf(stderr, "NIEZGODNOSC (tryb konca gry) w wierszu %d wyjscia\n", numer_wiersza_wyjscia);
+            abort();
+        }
+
+        if (znak == '\n')
+        {
+            numer_wiersza_wyjscia++;
+        }
+    } while (znak != EOF);
+
+    fclose(wejscie);
+    fclose(oczekiwane);
+    fclose(wyjscie);
+}
+
+/**
+    Argumenty programu (opcjonalne):
+    ZIARNO - ziarno generatora liczb pseudolosowych (domyslnie 1)
+    PARTIE - liczba losowych partii do rozegrania (domyslnie 10000)
+
+    Rozgrywa w paczkach po 'PARTIE_W_PACZCE' co najmniej 'PARTIE' losowych partii
+    porownujac oba silniki (patrz 'zapisz_losowe_polecenia') i tyle samo partii przez
+    petle trybu konca gry (patrz 'sprawdz_tryb_konca_gry'). Przy zgodnosci wypisuje
+    podsumowanie i konczy prace z kodem '0'.
+*/
+int main(int argc, char *argv[])
+{
+    uint64_t stan = argc > 1 ? strtoull(argv[1], NULL, 10) : 1;
+    long partie = argc > 2 ? atol(argv[2]) : 10000;
+    long rozegrane = (partie + PARTIE_W_PACZCE - 1) / PARTIE_W_PACZCE * PARTIE_W_PACZCE;
+
+    if (stan == 0)
+    {
+        stan = 1;
+    }
+
+    for (long g = 0; g < partie; g += PARTIE_W_PACZCE)
+    {
+        FILE *polecenia = plik_tymczasowy();
+
+        zapisz_losowe_polecenia(polecenia, &stan, PARTIE_W_PACZCE);
+        rewind(polecenia);
+        rozegraj_weryfikacje(polecenia);
+        fclose(polecenia);
+
+        sprawdz_tryb_konca_gry(&stan, PARTIE_W_PACZCE);
+    }
+
+    printf("Silniki zgodne w %ld partiach\n", rozegrane);
+    printf("Tryb konca gry zgodny w %ld partiach\n", rozegrane);
+
+    return 0;
+}
+
+#endif
+
+#elif defined(POMIAR)
+
+/**
+    TRYB POMIARU (kompilacja z -DPOMIAR)
+
+    Mierzy czas dzialania poszczegolnych funkcji programu na stalym zbiorze pozycji
+    ze srodkowej fazy gry i wypisuje wyniki w formacie JSON zgodnym z Google Benchmark
+    (pola "name", "iterations", "real_time", "cpu_time", "time_unit"). Wyniki mozna
+    porownac z zapisanym wczesniej plikiem skryptem 'porownaj_pomiary.py'.
+
+    Jedna iteracja kazdego pomiaru to jednokrotne przejscie przez wszystkie pozycje
+    zbioru, czasy sa podawane w nanosekundach na iteracje. Kazdy pomiar jest powtarzany
+    'POWTORZENIA_POMIARU' razy, zapisywany jest najkrotszy czas procesora (obliczenia sa
+    deterministyczne, wiec dluzsze czasy wynikaja z zaklocen) wraz z czasem rzeczywistym
+    tego samego powtorzenia. Pole "cpu_time_spread" podaje o ile procent mediana czasow
+    procesora przekracza minimum; skrypt porownujacy traktuje je jako poziom szumu.
+*/
+
+// minimalny czas jednego powtorzenia pomiaru w sekundach
+#define MINIMALNY_CZAS_POMIARU 0.1
+// liczba powtorzen pomiaru (nieparzysta, aby mediana uzyta do rozrzutu byla jednym z powtorzen)
+#define POWTORZENIA_POMIARU 15
+#define LICZBA_POZYCJI 8
+
+// pozycje zbioru zapisane jako ciagi ruchow od poczatku gry (po 20, 24, ..., 48 posuniec)
+static const char *korpus_ruchow[LICZBA_POZYCJI] = {
+    "f5f6c4f4g5b4g3d6g7h2c5c6f3e6c7g6b6g4h6e2",
+    "c4c3c2e3f5g6e2f4g5e6h7h5f7g3g4c5f6b3a2g7h8g8f8e8",
+    "f5d6c4d3c5f4d7b5g3f6f7c7b4d8a5h2c2c3d2d1e6g7h8b2b1g4g5h6",
+    "f5f6e6d6f7g8f8g6c3f4c6c5h6e7h8b6c4e3e8g7h7b2f3g2e2b3b5d1e1a4a7g3",
+    "f5d6c7g5g6g7d3c2f4c5b6g3g4b5h2c3b1b8h7a5c6d2a6e3d8c8a4b2d7b7f3a7c4a3b4b3",
+    "f5f4g3f6f7g5h4h5h6d6c7d7e7g4c5c6f3b5a4e6b4d8d3a5c3e3a6e8b6h3h2b3g2e2d1g7g6a3c8e1",
+    "e6d6c4f4c6c3g4e7f7b4f8e3e2f6g5d7c7d8c5b5b3a3b2b1a6g8a1a4b7c8a5a8e8a7h8f3g3e1d2g6b6h5g2d3",
+    "c4e3f3c5d3d2c6b4c1f4a3e2f5c7b3a4d6d1b8g5b6a7a5d7h6g2e7c2e1c8b1f6g3a6c3a2b2g4g7a8h3f7f1h2f8a1e6g6"
+};
+
+// pozycje zbioru, gracz do ktorego nalezy ruch oraz jego legalne ruchy
+static int korpus[LICZBA_POZYCJI][8][8];
+static int korpus_tura[LICZBA_POZYCJI];
+static int korpus_ruchy[LICZBA_POZYCJI][64];
+static int korpus_liczba_ruchow[LICZBA_POZYCJI];
+
+// suma wynikow mierzonych funkcji, zapobiega usunieciu obliczen przez kompilator
+static volatile long wynik_pomiaru;
+
+/**
+    Ustawia pozycje zbioru wykonujac ruchy z 'korpus_ruchow' od poczatku gry.
+*/
+static void przygotuj_korpus(void)
+{
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        const char *ruchy = korpus_ruchow[p];
+        int tura = 0;
+
+        inicjalizuj_plansze(korpus[p]);
+
+        for (size_t k = 0; ruchy[k] != '\0'; k += 2)
+        {
+            wykonaj_ruch(numer_wiersza(ruchy[k + 1]), numer_kolumny(ruchy[k]), tura, korpus[p]);
+            tura = 1 - tura;
+        }
+
+        korpus_tura[p] = tura;
+        korpus_liczba_ruchow[p] = znajdz_mozliwe_ruchy(korpus[p], tura, korpus_ruchy[p]);
+    }
+}
+
+typedef bool (*funkcja_sprawdzajaca)(int, int, int, int[8][8]);
+
+static const funkcja_sprawdzajaca funkcje_sprawdzajace[8] = {
+    sprawdz_pion_w_dol, sprawdz_pion_w_gore, sprawdz_poziom_w_prawo, sprawdz_poziom_w_lewo,
+    sprawdz_skos_w_prawo_w_gore, sprawdz_skos_w_lewo_w_gore,
+    sprawdz_skos_w_lewo_w_dol, sprawdz_skos_w_prawo_w_dol
+};
+
+static const char *nazwy_funkcji_sprawdzajacych[8] = {
+    "sprawdz_pion_w_dol", "sprawdz_pion_w_gore", "sprawdz_poziom_w_prawo", "sprawdz_poziom_w_lewo",
+    "sprawdz_skos_w_prawo_w_gore", "sprawdz_skos_w_lewo_w_gore",
+    "sprawdz_skos_w_lewo_w_dol", "sprawdz_skos_w_prawo_w_dol"
+};
+
+/**
+    Wywoluje funkcje sprawdzajaca 'kierunek' dla kazdego pustego pola kazdej pozycji.
+*/
+static void zmierz_sprawdz(int kierunek)
+{
+    funkcja_sprawdzajaca sprawdz = funkcje_sprawdzajace[kierunek];
+    long suma = 0;
+
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            for (int j = 0; j < 8; j++)
+            {
+                if (korpus[p][i][j] == -1)
+                {
+                    suma += sprawdz(i, j, korpus_tura[p], korpus[p]);
+                }
+            }
+        }
+    }
+
+    wynik_pomiaru += suma;
+}
+
+/**
+    Wykonuje kazdy legalny ruch kazdej pozycji na kopii planszy (czas zawiera kopiowanie).
+*/
+static void zmierz_wykonaj_ruch(int nieuzywany)
+{
+    int plansza[8][8];
+    (void) nieuzywany;
+
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        for (int k = 0; k < korpus_liczba_ruchow[p]; k++)
+        {
+            int pole = korpus_ruchy[p][k];
+
+            memcpy(plansza, korpus[p], sizeof(plansza));
+            wykonaj_ruch(pole / 8, pole % 8, korpus_tura[p], plansza);
+            wynik_pomiaru += plansza[pole / 8][pole % 8];
+        }
+    }
+}
+
+/**
+    Tworzy tekst zachety kazdej pozycji bez wypisywania go (zapisz_mozliwe_ruchy,
+    czyli 'pokaz_mozliwe_ruchy' bez wejscia-wyjscia: wyszukanie ruchow i formatowanie).
+*/
+static void zmierz_zapisz_mozliwe_ruchy(int nieuzywany)
+{
+    char tekst[DLUGOSC_ZACHETY];
+    (void) nieuzywany;
+
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        zapisz_mozliwe_ruchy(korpus[p], korpus_tura[p], NULL, tekst);
+        wynik_pomiaru += tekst[1];
+    }
+}
+
+/**
+    Inicjalizuje plansze tyle razy ile jest pozycji w zbiorze.
+*/
+static void zmierz_inicjalizuj_plansze(int nieuzywany)
+{
+    int plansza[8][8];
+    (void) nieuzywany;
+
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        inicjalizuj_plansze(plansza);
+        wynik_pomiaru += plansza[3][3];
+    }
+}
+
+/**
+    Zamienia wszystkie nazwy pol z 'korpus_ruchow' na numery wiersza i kolumny tablicy.
+*/
+static void zmierz_polecenia(int nieuzywany)
+{
+    long suma = 0;
+    (void) nieuzywany;
+
+    for (int p = 0; p < LICZBA_POZYCJI; p++)
+    {
+        const char *ruchy = korpus_ruchow[p];
+
+        for (size_t k = 0; ruchy[k] != '\0'; k += 2)
+        {
+            suma += numer_kolumny(ruchy[k]) + 8 * numer_wiersza(ruchy[k + 1]);
+        }
+    }
+
+    wynik_pomiaru += suma;
+}
+
+/**
+    'nazwa' - nazwa pomiaru w pliku JSON
+    'funkcja' - mierzona funkcja wykonujaca jedna iteracje
+    'argument' - argument przekazywany funkcji 'funkcja'
+    'pierwszy' - czy jest to pierwszy wypisywany pomiar
+
+    Dobiera liczbe iteracji tak by pomiar trwal co najmniej 'MINIMALNY_CZAS_POMIARU',
+    a nastepnie wypisuje w formacie JSON czasy powtorzenia o najkrotszym czasie procesora
+    sposrod 'POWTORZENIA_POMIARU' powtorzen oraz rozrzut czasow procesora.
+*/
+static void zmierz(const char *nazwa, void (*funkcja)(int), int argument, bool pierwszy)
+{
+    long iteracje = 1;
+    double czas;
+
+    // dobranie liczby iteracji
+    while (true)
+    {
+        double start = sekundy();
+
+        for (long n = 0; n < iteracje; n++)
+        {
+            funkcja(argument);
+        }
+
+        czas = sekundy() - start;
+        if (czas >= MINIMALNY_CZAS_POMIARU)
+        {
+            break;
+        }
+        iteracje *= 2;
+    }
+
+    // czasy rzeczywiste i czasy procesora kolejnych powtorzen
+    double czasy[POWTORZENIA_POMIARU];
+    double czasy_cpu[POWTORZENIA_POMIARU];
+
+    for (int r = 0; r < POWTORZENIA_POMIARU; r++)
+    {
+        // czas rzeczywisty obejmuje caly przedzial pomiaru czasu procesora
+        double start = sekundy();
+        clock_t start_cpu = clock();
+
+        for (long n = 0; n < iteracje; n++)
+        {
+            funkcja(argument);
+        }
+
+        czasy_cpu[r] = (double) (clock() - start_cpu) / CLOCKS_PER_SEC;
+        czasy[r] = sekundy() - start;
+    }
+
+    // sortowanie przez wstawianie powtorzen wedlug czasu procesora
+    for (int r = 1; r < POWTORZENIA_POMIARU; r++)
+    {
+        double czas_r = czasy[r];
+        double czas_cpu_r = czasy_cpu[r];
+        int k = r - 1;
+
+        while (k >= 0 && czasy_cpu[k] > czas_cpu_r)
+        {
+            czasy[k + 1] = czasy[k];
+            czasy_cpu[k + 1] = czasy_cpu[k];
+            k--;
+        }
+
+        czasy[k + 1] = czas_r;
+        czasy_cpu[k + 1] = czas_cpu_r;
+    }
+
+    // rozrzut: o ile procent mediana czasu procesora przekracza jego minimum
+    double rozrzut = (czasy_cpu[POWTORZENIA_POMIARU / 2] - czasy_cpu[0]) / czasy_cpu[0] * 100.0;
+
+    printf("%s    {\"name\": \"%s\", \"iterations\": %ld, \"real_time\": %.3f, "
+           "\"cpu_time\": %.3f, \"cpu_time_spread\": %.2f, \"time_unit\": \"ns\"}",
+           pierwszy ? "" : ",\n", nazwa, iteracje,
+           czasy[0] * 1e9 / iteracje, czasy_cpu[0] * 1e9 / iteracje, rozrzut);
+}
+
+/**
+    Wypisuje na standardowe wyjscie wyniki wszystkich pomiarow w formacie JSON.
+*/
+int main(void)
+{
+    przygotuj_korpus();
+
+    printf("{\n  \"context\": {\"corpus_positions\": %d},\n  \"benchmarks\": [\n", LICZBA_POZYCJI);
+
+    for (int k = 0; k < 8; k++)
+    {
+        zmierz(nazwy_funkcji_sprawdzajacych[k], zmierz_sprawdz, k, k == 0);
+    }
+    zmierz("wykonaj_ruch", zmierz_wykonaj_ruch, 0, false);
+    zmierz("zapisz_mozliwe_ruchy", zmierz_zapisz_mozliwe_ruchy, 0, false);
+    zmierz("inicjalizuj_plansze", zmierz_inicjalizuj_plansze, 0, false);
+    zmierz("numer_kolumny_numer_wiersza", zmierz_polecenia, 0, false);
+
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
+
+#else
+
+/**
+    'tekst' - argument programu
+    'minimum', 'maksimum' - dopuszczalny zakres wartosci
+    'wynik' - miejsce na wczytana liczbe
+
+    Zwraca wartosc logiczna informujaca czy 'tekst' jest w calosci liczba calkowita
+    z przedzialu ['minimum', 'maksimum']. Tylko wtedy wpisuje ja do 'wynik'.
+*/
+static bool wczytaj_liczbe(const char *tekst, int minimum, int maksimum, int *wynik)
+{
+    char *koniec;
+    long liczba = strtol(tekst, &koniec, 10);
+
+    if (koniec == tekst || *koniec != '\0' || liczba < minimum || liczba > maksimum)
+    {
+        return false;
+    }
+
+    *wynik = (int) liczba;
+    return true;
+}
+
+/**
+    Wypisuje na standardowe wyjscie bledow opis argumentow programu.
+*/
+static void pokaz_uzycie(const char *program)
+{
+    fprintf(stderr, "Uzycie: %s [-g N] [-t MS] [-k]\n"
+                    "  -g N   glebokosc analizy, liczba calkowita od 1 do %d\n"
+                    "  -t MS  limit czasu analizy w milisekundach, dodatnia liczba calkowita\n"
+                    "  -k     tryb konca gry\n", program, MAKS_GLEBOKOSC);
+}
+
+/**
+    Argumenty programu (opcjonalne):
+    -g N - ocena kazdego legalnego ruchu przeszukiwaniem o glebokosci N [1 - 60]
+    -t MS - ocena kazdego legalnego ruchu w limicie MS (liczba dodatnia) milisekund czasu
+            rzeczywistego na tekst zachety (liczonym od rozpoczecia analizy pozycji)
+    -k - tryb konca gry (patrz 'graj_z_koncem_gry')
+
+    Przy niepoprawnych argumentach wypisuje opis uzycia i konczy prace z kodem '1'.
+    Bez argumentow program dziala dokladnie tak jak opisano w naglowku pliku.
+*/
+int main(int argc, char *argv[])
+{   
+    // parametry trybu analizy
+    bool analiza = false;
+    int glebokosc_analizy = MAKS_GLEBOKOSC;
+    int limit_analizy_ms = 0;
+    // zmienna logiczna informujaca o wlaczeniu trybu konca gry
+    bool tryb_konca = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc &&
+            wczytaj_liczbe(argv[i + 1], 1, MAKS_GLEBOKOSC, &glebokosc_analizy))
+        {
+            analiza = true;
+            i++;
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc &&
+                 wczytaj_liczbe(argv[i + 1], 1, INT_MAX, &limit_analizy_ms))
+        {
+            analiza = true;
+            i++;
+        }
+        else if (strcmp(argv[i], "-k") == 0)
+        {
+            tryb_konca = true;
+        }
+        else
+        {
+            pokaz_uzycie(argv[0]);
+            return 1;
+        }
+    }
+
+    if (tryb_konca)
+    {
+        graj_z_koncem_gry(stdin, stdout, analiza, glebokosc_analizy, limit_analizy_ms);
+        return 0;
+    }
+
+    // oceny legalnych ruchow wyznaczane w trybie analizy
+    int oceny[8][8];
+
+    // zmienna logiczna informujaca o kontynuacji gry
+    bool gra_trwa = true;
+    // informuje do ktorego gracza nalezy ruch
+    int tura = 0;
+
+    // symbole graczy do ktorych latwo mozna sie odwolac z uzyciem 'gracze['tura']'
+    char gracze[] = {'C', 'B'};
+
+    int plansza[8][8];
+    inicjalizuj_plansze(plansza);
+
+    // liczba odpowiadajaca pierwszemu wprowadzonemu znakowi wedlug systemu ASCII
+    int wiersz_ascii;
+    // liczba odpowiadajaca drugiemu ewentualnie wprowadzonemu znakowi wedlug systemu ASCII
+    int kolumna_ascii;
+    // pierwsza wspolrzedna pola w tablicy 'plansza'
+    int wiersz;
+    // druga wspolrzedna pola w tablicy 'plansza'
+    int kolumna;
+    
+    while (gra_trwa)
+    {   
+        // wyswietlenie tekstu zachety
+        printf("%c", gracze[tura]);
+        if (analiza)
+        {
+            analizuj_pozycje(plansza, tura, glebokosc_analizy, limit_analizy_ms, oceny);
+            pokaz_mozliwe_ruchy(plansza, tura, oceny);
+        }
+        else
+        {
+            pokaz_mozliwe_ruchy(plansza, tura, NULL);
+        }
+        printf("\n");
+
+        // zczytanie pierwszego znaku
+        kolumna_ascii = getchar();
+        
+        switch (kolumna_ascii)
+        {
+            case '-': // rezygnacja z ruchu
+                break;
+            case '=': // przerwanie gry
+                gra_trwa = false;
+                break;
+            default: // zczytanie drugiego symobolu i wykonanie legalnego ruchu
+
+                /* 
+                    Konwersja zczytanego symbolu kolumny na odpowiadajacy mu numer
+                    kolumny w tablicy 'plansza' reprezentujacej plansze
+                */
+                kolumna = numer_kolumny((char) kolumna_ascii);
+                
+
+                /*
+                    Zczytanie i konwersja numeru wiersza na odpowiadajacy mu numer
+                    wiersza w tablicy 'plansza' reprezentujacej plansze
+                */
+                wiersz_ascii = getchar();
+                wiersz = numer_wiersza((char) wiersz_ascii);
+
+                wykonaj_ruch(wiersz, kolumna, tura, plansza);
+                
+                break;
+        }
+        
+        // zczytanie znaku reprezentujacego koniec wiersza
+        getchar();
+
+        // przekazanie ruchu nastepnemu graczowi
+        tura = 1 - tura;
+    }
+    
+    return 0;
+}
+
+#endif